@@ -8,6 +8,8 @@
 
 namespace e2e {
 
+struct MontgomeryContext;
+
 /**
  * @brief Класс для работы с большими целыми числами
  * Используется для арифметики в конечных полях
@@ -16,6 +18,12 @@ class BigInt {
 public:
     BigInt();
     explicit BigInt(uint64_t value);
+    /**
+     * @brief Разбор hex без префикса: любой регистр, любая длина (в том числе
+     * нечетная, например "1"), пустая строка - ноль. Символы разбираются сразу
+     * в 32-битные слова через parseHexWords, без промежуточного вектора байт
+     * @throws std::invalid_argument при недопустимом символе
+     */
     explicit BigInt(const std::string& hex_string);
     explicit BigInt(const std::vector<uint8_t>& bytes, bool little_endian = false);
     
@@ -55,6 +63,11 @@ public:
     BigInt modInverse(const BigInt& modulus) const; // Обратный элемент по модулю
     BigInt modPow(const BigInt& exponent, const BigInt& modulus) const; // Возведение в степень
     
+    // Арифметика Монтгомери (операнды в форме Монтгомери: a * R mod m)
+    BigInt toMontgomery(const MontgomeryContext& ctx) const;   // a * R mod m
+    BigInt fromMontgomery(const MontgomeryContext& ctx) const; // a * R^-1 mod m
+    BigInt montgomeryMul(const BigInt& other, const MontgomeryContext& ctx) const; // a * b * R^-1 mod m
+    
     // Вспомогательные функции
     bool isZero() const;
     bool isOne() const;
@@ -64,7 +77,7 @@ public:
     
     // Конвертация
     std::vector<uint8_t> toBytes(size_t min_bytes = 0, bool little_endian = false) const;
-    std::string toHex() const;
+    std::string toHex() const; // Строчные буквы, без ведущих нулей, ноль - "0"
     std::string toDecimal() const;
     
     // Генерация случайного числа
@@ -91,8 +104,34 @@ private:
     std::vector<uint32_t> multiplyDigits(const std::vector<uint32_t>& other) const;
     std::pair<BigInt, BigInt> divideDigits(const BigInt& divisor) const;
     
+    /**
+     * @brief Разобрать hex в слова base 2^32 (младшее слово первым)
+     * Группы по 8 символов с конца; неполная старшая группа допустима.
+     * Проверка символов - utils::detail::decodeHexNibbles (общее ядро с utils::fromHex)
+     */
+    static std::vector<uint32_t> parseHexWords(const char* hex, size_t size);
+    
     // Модульная арифметика
-    BigInt montgomeryReduce(const BigInt& other, const BigInt& modulus, const BigInt& r_inv) const;
+    // Редукция REDC по словам: t * R^-1 mod m, использует ctx.m_prime
+    static BigInt montgomeryReduce(const std::vector<uint32_t>& t, const MontgomeryContext& ctx);
+};
+
+/**
+ * @brief Предвычисленные константы Монтгомери для нечетного модуля m
+ * R = 2^(32 * limbs), используются BigInt::toMontgomery/fromMontgomery/montgomeryMul
+ */
+struct MontgomeryContext {
+    BigInt modulus;   // Модуль m
+    BigInt r;         // R mod m
+    BigInt r2;        // R^2 mod m (перевод в форму Монтгомери)
+    size_t limbs;     // Число 32-битных слов модуля
+    uint32_t m_prime; // -m^-1 mod 2^32
+    
+    /**
+     * @brief Вычислить константы для модуля
+     * @throws std::invalid_argument если модуль четный или нулевой
+     */
+    static MontgomeryContext forModulus(const BigInt& modulus);
 };
 
 std::ostream& operator<<(std::ostream& os, const BigInt& bi);
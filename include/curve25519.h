@@ -0,0 +1,220 @@
+#ifndef CURVE25519_H
+#define CURVE25519_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace e2e {
+
+/**
+ * @brief Элемент поля GF(2^255 - 19)
+ * Пять 51-битных лимбов (little-endian), произведение лимбов помещается в 128 бит
+ */
+struct Fe25519 {
+    uint64_t v[5];
+};
+
+/**
+ * @brief Арифметика в поле GF(2^255 - 19) на 51-битных лимбах
+ * Все операции выполняются за постоянное время
+ */
+class Field25519 {
+public:
+    static Fe25519 zero();
+    static Fe25519 one();
+    
+    /**
+     * @brief Загрузить элемент из 32 байт (little-endian, старший бит игнорируется)
+     */
+    static Fe25519 fromBytes(const uint8_t* in);
+    
+    /**
+     * @brief Сохранить полностью редуцированный элемент в 32 байта (little-endian)
+     */
+    static void toBytes(const Fe25519& f, uint8_t* out);
+    
+    static Fe25519 add(const Fe25519& f, const Fe25519& g);
+    static Fe25519 sub(const Fe25519& f, const Fe25519& g);
+    static Fe25519 neg(const Fe25519& f);
+    static Fe25519 mul(const Fe25519& f, const Fe25519& g);
+    static Fe25519 square(const Fe25519& f);
+    
+    /**
+     * @brief Умножение на константу a24 = 121666 (шаг лестницы Монтгомери)
+     */
+    static Fe25519 mul121666(const Fe25519& f);
+    
+    /**
+     * @brief Обратный элемент f^(p-2)
+     */
+    static Fe25519 invert(const Fe25519& f);
+    
+    /**
+     * @brief f^((p-5)/8) - для извлечения квадратного корня при распаковке точки
+     */
+    static Fe25519 pow22523(const Fe25519& f);
+    
+    /**
+     * @brief Условный обмен f и g без ветвлений (swap = 0 или 1)
+     */
+    static void cswap(Fe25519& f, Fe25519& g, uint64_t swap);
+    
+    static bool isNegative(const Fe25519& f);
+    static bool isZero(const Fe25519& f);
+};
+
+/**
+ * @brief X25519 - обмен ключами на Curve25519 (RFC 7748)
+ * Лестница Монтгомери только по координате u
+ */
+class X25519 {
+public:
+    static constexpr size_t KEY_SIZE = 32;
+    
+    /**
+     * @brief Вычислить публичный ключ (k * 9)
+     * @param private_key 32 байта, зажимается (clamp) внутри
+     */
+    static std::vector<uint8_t> publicKey(const std::vector<uint8_t>& private_key);
+    
+    /**
+     * @brief Вычислить общий секрет k * U
+     * @throws std::invalid_argument если ключи не 32 байта или результат нулевой
+     * (публичный ключ малого порядка)
+     */
+    static std::vector<uint8_t> sharedSecret(
+        const std::vector<uint8_t>& private_key,
+        const std::vector<uint8_t>& peer_public_key
+    );
+
+private:
+    /**
+     * @brief Лестница Монтгомери: u-координата scalar * u
+     */
+    static Fe25519 ladder(const uint8_t* scalar, const Fe25519& u);
+    
+    /**
+     * @brief Зажатие скаляра: сброс битов 0-2 и 255, установка бита 254
+     */
+    static void clamp(uint8_t* scalar);
+};
+
+/**
+ * @brief Точка на кривой Эдвардса edwards25519 в расширенных координатах
+ * x = X/Z, y = Y/Z, x*y = T/Z
+ */
+struct Ge25519 {
+    Fe25519 X;
+    Fe25519 Y;
+    Fe25519 Z;
+    Fe25519 T;
+};
+
+/**
+ * @brief Подписи Ed25519 (RFC 8032)
+ * Приватный ключ - 32-байтное зерно (seed), скаляр получается из SHA-512(seed)
+ */
+class Ed25519 {
+public:
+    static constexpr size_t SEED_SIZE = 32;
+    static constexpr size_t PUBLIC_KEY_SIZE = 32;
+    static constexpr size_t SIGNATURE_SIZE = 64;
+    
+    /**
+     * @brief Вычислить публичный ключ A = s * B
+     */
+    static std::vector<uint8_t> publicKey(const std::vector<uint8_t>& seed);
+    
+    /**
+     * @brief Создать подпись (R || S, 64 байта)
+     */
+    static std::vector<uint8_t> sign(
+        const std::vector<uint8_t>& message,
+        const std::vector<uint8_t>& seed
+    );
+    
+    /**
+     * @brief Проверить подпись
+     * Кофакторное уравнение RFC 8032 (разд. 5.1.7): [8][S]B = [8]R + [8][k]A,
+     * k = SHA-512(R || A || M) mod L; S должен быть < L, R и A - корректные
+     * кодирования точек. Совпадает с verifyBatch для любой подписи,
+     * в том числе с R или A малого порядка
+     */
+    static bool verify(
+        const std::vector<uint8_t>& message,
+        const std::vector<uint8_t>& signature,
+        const std::vector<uint8_t>& public_key
+    );
+    
+    /**
+     * @brief Пакетная проверка подписей
+     * Проверяет случайную линейную комбинацию кофакторных уравнений
+     * [8](sum z_i S_i)B = [8](sum z_i R_i) + [8](sum z_i k_i A_i) одним
+     * мультискалярным умножением. Возвращает true тогда и только тогда, когда
+     * verify вернул бы true для каждой подписи (с точностью до вероятности 2^-128);
+     * при неудаче пакета результат false (без указания виновной подписи).
+     * Пустой пакет - true
+     * @throws std::invalid_argument если размеры векторов не совпадают
+     */
+    static bool verifyBatch(
+        const std::vector<std::vector<uint8_t>>& messages,
+        const std::vector<std::vector<uint8_t>>& signatures,
+        const std::vector<std::vector<uint8_t>>& public_keys
+    );
+    
+    /**
+     * @brief Преобразовать публичный ключ Ed25519 в X25519: u = (1 + y) / (1 - y)
+     * @throws std::invalid_argument если ключ не является точкой кривой
+     */
+    static std::vector<uint8_t> toX25519PublicKey(const std::vector<uint8_t>& public_key);
+    
+    /**
+     * @brief Преобразовать зерно Ed25519 в приватный ключ X25519 (первые 32 байта SHA-512(seed))
+     */
+    static std::vector<uint8_t> toX25519PrivateKey(const std::vector<uint8_t>& seed);
+    
+    /**
+     * @brief Распаковать точку из 32 байт (y и знак x)
+     * @return false если байты не кодируют точку кривой
+     */
+    static bool decodePoint(const uint8_t* in, Ge25519& point);
+    
+    /**
+     * @brief Упаковать точку в 32 байта
+     */
+    static void encodePoint(const Ge25519& point, uint8_t* out);
+
+private:
+    /**
+     * @brief s * B по предвычисленной таблице кратных базовой точки
+     */
+    static Ge25519 scalarMultiplyBase(const uint8_t* scalar);
+    
+    /**
+     * @brief a * A + b * B (переменное время, только для проверки подписи)
+     */
+    static Ge25519 doubleScalarMultiply(const uint8_t* a, const Ge25519& A, const uint8_t* b);
+    
+    static Ge25519 add(const Ge25519& P, const Ge25519& Q);
+    static Ge25519 doublePoint(const Ge25519& P);
+    
+    /**
+     * @brief Редукция 64-байтного числа по модулю порядка L
+     */
+    static void reduceScalar(const uint8_t* in64, uint8_t* out32);
+    
+    /**
+     * @brief (a * b + c) mod L
+     */
+    static void mulAddScalar(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* out32);
+    
+    /**
+     * @brief Проверка S < L (защита от пластичности подписи)
+     */
+    static bool isCanonicalScalar(const uint8_t* s);
+};
+
+} // namespace e2e
+
+#endif // CURVE25519_H
@@ -3,6 +3,7 @@
 
 #include "ecc_keypair.h"
 #include "ecdh.h"
+#include "wire_format.h"
 #include <vector>
 #include <string>
 
@@ -11,7 +12,8 @@ namespace e2e {
 /**
  * @brief Класс для шифрования/расшифрования данных с использованием ECC
  * Реализует ECIES (Elliptic Curve Integrated Encryption Scheme)
- * Использует ECDH для обмена ключами + AES для шифрования данных
+ * Использует ECDH для обмена ключами + AEAD (AES-256-CTR + HMAC-SHA256,
+ * encrypt-then-MAC) для шифрования данных
  */
 class ECCEncryption {
 public:
@@ -19,44 +21,108 @@ public:
      * @brief Зашифровать данные публичным ключом получателя
      * @param plaintext Исходные данные
      * @param recipient_public_key Публичный ключ получателя
-     * @param curve Параметры кривой
-     * @return Зашифрованные данные (включая эфемерный публичный ключ, IV, tag, ciphertext)
+     * @param curve Кривая из реестра
+     * @return Конверт в бинарном формате wire (эфемерный ключ, nonce, ciphertext, tag)
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static std::vector<uint8_t> encrypt(
         const std::vector<uint8_t>& plaintext,
         const ECPoint& recipient_public_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
     
     /**
      * @brief Расшифровать данные приватным ключом получателя
      * @param ciphertext Зашифрованные данные
      * @param recipient_private_key Приватный ключ получателя
-     * @param curve Параметры кривой
+     * @param curve Кривая из реестра
      * @return Расшифрованные данные
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
+     * @throws std::invalid_argument при ошибке разбора конверта или несовпадении тега
      */
     static std::vector<uint8_t> decrypt(
         const std::vector<uint8_t>& ciphertext,
         const BigInt& recipient_private_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
+    );
+    
+    /**
+     * @brief Зашифровать данные публичным ключом получателя на любой кривой реестра
+     * secp256r1 - эфемерный ECDH, Curve25519 - эфемерный X25519
+     * @param recipient_public_key Ключ получателя (getKeyAgreementPublicKey)
+     */
+    static std::vector<uint8_t> encrypt(
+        const std::vector<uint8_t>& plaintext,
+        const std::vector<uint8_t>& recipient_public_key,
+        const Curve& curve
+    );
+    
+    /**
+     * @brief Расшифровать данные ключевой парой получателя (кривая берется из пары)
+     * @throws std::invalid_argument при ошибке разбора, несовпадении кривой или тега
+     */
+    static std::vector<uint8_t> decrypt(
+        const std::vector<uint8_t>& ciphertext,
+        const ECCKeyPair& recipient_keys
+    );
+    
+    /**
+     * @brief Размер конверта для открытого текста заданной длины
+     * Равен wire::envelopeSize(curve, plaintext_size) (AEAD не меняет длину данных)
+     */
+    static size_t envelopeSize(const Curve& curve, size_t plaintext_size);
+    
+    /**
+     * @brief Зашифровать данные в буфер вызывающего
+     * Шифртекст и тег пишутся прямо в out; аллокаций, зависящих от размера
+     * данных, нет (выделяются только ключи фиксированной длины)
+     * @param out Буфер не меньше envelopeSize(curve, plaintext_size)
+     * @return Количество записанных байт
+     * @throws std::invalid_argument если буфер мал
+     */
+    static size_t encryptInto(
+        const uint8_t* plaintext,
+        size_t plaintext_size,
+        const std::vector<uint8_t>& recipient_public_key,
+        const Curve& curve,
+        uint8_t* out,
+        size_t capacity
+    );
+    
+    /**
+     * @brief Расшифровать конверт в буфер вызывающего
+     * Тег проверяется до расшифрования; при ошибке out не изменяется
+     * @param out Буфер не меньше длины шифртекста в конверте
+     * @return Количество записанных байт
+     * @throws std::invalid_argument при ошибке разбора, несовпадении кривой или тега
+     */
+    static size_t decryptInto(
+        const uint8_t* envelope,
+        size_t envelope_size,
+        const ECCKeyPair& recipient_keys,
+        uint8_t* out,
+        size_t capacity
     );
     
     /**
      * @brief Зашифровать строку
+     * Текстовый вариант: конверт wire в hex (для бинарного канала - encrypt/encryptInto)
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static std::string encryptString(
         const std::string& plaintext,
         const ECPoint& recipient_public_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
     
     /**
      * @brief Расшифровать строку
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static std::string decryptString(
         const std::string& ciphertext_hex,
         const BigInt& recipient_private_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
 
 private:
@@ -89,6 +155,59 @@ private:
         const std::vector<uint8_t>& iv
     );
     
+    /**
+     * @brief AES-256-CTR над буфером вызывающего (out может совпадать с in)
+     * @param key 32 байта
+     * @param iv wire::NONCE_SIZE байт
+     */
+    static void aesCtrXor(
+        const uint8_t* in,
+        size_t size,
+        const uint8_t* key,
+        const uint8_t* iv,
+        uint8_t* out
+    );
+    
+    /**
+     * @brief Длина ключа AEAD: ключ AES (32) || ключ HMAC (32)
+     */
+    static constexpr size_t AEAD_KEY_SIZE = 64;
+    
+    /**
+     * @brief AEAD-шифрование (encrypt-then-MAC)
+     * tag = HMAC-SHA256(mac_key, aad || nonce || ciphertext), усеченный до wire::TAG_SIZE;
+     * aad - заголовок и эфемерный ключ конверта
+     * @param key AEAD_KEY_SIZE байт (из deriveKey)
+     * @param ciphertext_out Буфер размером size
+     * @param tag_out Буфер размером wire::TAG_SIZE
+     */
+    static void sealAEAD(
+        const uint8_t* plaintext,
+        size_t size,
+        const uint8_t* key,
+        const uint8_t* nonce,
+        const uint8_t* aad,
+        size_t aad_size,
+        uint8_t* ciphertext_out,
+        uint8_t* tag_out
+    );
+    
+    /**
+     * @brief AEAD-расшифрование: тег сравнивается за постоянное время до расшифрования
+     * @param plaintext_out Буфер размером size, не изменяется при неверном теге
+     * @return false если тег не совпал
+     */
+    static bool openAEAD(
+        const uint8_t* ciphertext,
+        size_t size,
+        const uint8_t* key,
+        const uint8_t* nonce,
+        const uint8_t* aad,
+        size_t aad_size,
+        const uint8_t* tag,
+        uint8_t* plaintext_out
+    );
+    
     /**
      * @brief KDF (Key Derivation Function) - извлечение ключа из общего секрета
      */
@@ -97,6 +216,15 @@ private:
         size_t key_length,
         const std::vector<uint8_t>& salt = {}
     );
+    
+    /**
+     * @brief KDF для общего секрета в байтах (X25519)
+     */
+    static std::vector<uint8_t> deriveKey(
+        const std::vector<uint8_t>& shared_secret,
+        size_t key_length,
+        const std::vector<uint8_t>& salt = {}
+    );
 };
 
 } // namespace e2e
@@ -3,6 +3,7 @@
 
 #include "elliptic_curve.h"
 #include "bigint.h"
+#include <array>
 #include <string>
 #include <vector>
 
@@ -10,82 +11,124 @@ namespace e2e {
 
 /**
  * @brief Класс для работы с парой ключей ECC (приватный и публичный)
+ * Для Curve25519 хранятся 32-байтное зерно Ed25519 и 32-байтное кодирование
+ * публичного ключа Ed25519 (RFC 8032); ключи X25519 выводятся из них.
+ * BigInt/ECPoint-представление для Curve25519 не используется
  */
 class ECCKeyPair {
 public:
     /**
      * @brief Конструктор - генерирует новую пару ключей
-     * @param curve Параметры кривой (по умолчанию secp256r1)
+     * @param curve Кривая из реестра (по умолчанию secp256r1)
      */
-    explicit ECCKeyPair(const CurveParams& curve = EllipticCurve::getSecp256r1Params());
+    explicit ECCKeyPair(const Curve& curve = CurveRegistry::secp256r1());
     
     /**
      * @brief Конструктор из существующего приватного ключа
      * @param private_key Приватный ключ (BigInt)
-     * @param curve Параметры кривой
+     * @param curve Кривая из реестра
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
-    ECCKeyPair(const BigInt& private_key, const CurveParams& curve = EllipticCurve::getSecp256r1Params());
+    explicit ECCKeyPair(const BigInt& private_key, const Curve& curve = CurveRegistry::secp256r1());
     
     /**
      * @brief Конструктор из приватного ключа в hex формате
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
-    ECCKeyPair(const std::string& private_key_hex, const CurveParams& curve = EllipticCurve::getSecp256r1Params());
+    explicit ECCKeyPair(const std::string& private_key_hex, const Curve& curve = CurveRegistry::secp256r1());
+    
+    /**
+     * @brief Конструктор из зерна Ed25519
+     * @throws std::invalid_argument если curve не CURVE25519
+     */
+    ECCKeyPair(const std::array<uint8_t, 32>& seed, const Curve& curve);
     
     /**
      * @brief Получить приватный ключ
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
-    const BigInt& getPrivateKey() const { return private_key_; }
+    const BigInt& getPrivateKey() const;
     
     /**
      * @brief Получить публичный ключ (точка на кривой)
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
+     */
+    const ECPoint& getPublicKey() const;
+    
+    /**
+     * @brief Получить зерно Ed25519
+     * @throws std::invalid_argument если кривая не CURVE25519
      */
-    const ECPoint& getPublicKey() const { return public_key_; }
+    const std::array<uint8_t, 32>& getSeed() const;
+    
+    /**
+     * @brief Получить приватный ключ фиксированной длины (curve.orderBytes() байт, big-endian)
+     * Для Curve25519 - зерно Ed25519 в исходном порядке байт
+     */
+    std::vector<uint8_t> getPrivateKeyBytes() const;
     
     /**
      * @brief Получить приватный ключ в hex формате
+     * Для Curve25519 - hex зерна в исходном порядке байт
      */
     std::string getPrivateKeyHex() const;
     
     /**
      * @brief Получить публичный ключ в hex формате (x, y)
+     * Для Curve25519 - hex 32-байтного кодирования Ed25519
      */
     std::string getPublicKeyHex() const;
     
     /**
      * @brief Получить публичный ключ в сжатом формате (0x02/0x03 + x)
+     * Для Curve25519 - 32-байтное кодирование Ed25519
      */
     std::vector<uint8_t> getPublicKeyCompressed() const;
     
     /**
      * @brief Получить публичный ключ в несжатом формате (0x04 + x + y)
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     std::vector<uint8_t> getPublicKeyUncompressed() const;
     
+    /**
+     * @brief Получить публичный ключ для обмена ключами
+     * secp256r1 - сжатый формат, Curve25519 - u-координата X25519
+     */
+    std::vector<uint8_t> getKeyAgreementPublicKey() const;
+    
     /**
      * @brief Загрузить публичный ключ из сжатого формата
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
-    static ECPoint loadPublicKeyCompressed(const std::vector<uint8_t>& compressed, const CurveParams& curve = EllipticCurve::getSecp256r1Params());
+    static ECPoint loadPublicKeyCompressed(const std::vector<uint8_t>& compressed, const Curve& curve = CurveRegistry::secp256r1());
     
     /**
      * @brief Загрузить публичный ключ из несжатого формата
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
-    static ECPoint loadPublicKeyUncompressed(const std::vector<uint8_t>& uncompressed, const CurveParams& curve = EllipticCurve::getSecp256r1Params());
+    static ECPoint loadPublicKeyUncompressed(const std::vector<uint8_t>& uncompressed, const Curve& curve = CurveRegistry::secp256r1());
     
     /**
      * @brief Проверить валидность ключа
+     * Вейерштрасс: 0 < d < n и публичная точка лежит на кривой.
+     * CURVE25519: любое 32-байтное зерно допустимо (скаляр получается из
+     * SHA-512 и зажимается), проверяется, что сохраненный публичный ключ
+     * совпадает с Ed25519::publicKey(seed)
      */
     bool isValid() const;
     
     /**
      * @brief Получить кривую
      */
-    const CurveParams& getCurve() const { return curve_; }
+    const Curve& getCurve() const { return *curve_; }
 
 private:
-    BigInt private_key_;
-    ECPoint public_key_;
-    CurveParams curve_;
-    EllipticCurve curve_impl_;
+    BigInt private_key_;   // Только для кривых Вейерштрасса
+    ECPoint public_key_;   // Только для кривых Вейерштрасса
+    std::array<uint8_t, 32> seed_{};               // Только для CURVE25519
+    std::array<uint8_t, 32> encoded_public_key_{}; // Только для CURVE25519 (Ed25519)
+    const Curve* curve_; // Принадлежит CurveRegistry
     
     void generatePublicKey();
 };
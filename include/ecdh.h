@@ -17,13 +17,14 @@ public:
      * @brief Вычислить общий секретный ключ
      * @param private_key Приватный ключ одной стороны
      * @param public_key Публичный ключ другой стороны
-     * @param curve Параметры кривой
+     * @param curve Кривая из реестра
      * @return Общий секретный ключ (точка k*Q, где k - приватный ключ, Q - публичный ключ)
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static ECPoint computeSharedSecret(
         const BigInt& private_key,
         const ECPoint& public_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
     
     /**
@@ -32,12 +33,27 @@ public:
      * @param public_key Публичный ключ другой стороны
      * @param key_length Длина ключа в байтах (по умолчанию 32 для AES-256)
      * @return Байты общего секретного ключа
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static std::vector<uint8_t> deriveKey(
         const BigInt& private_key,
         const ECPoint& public_key,
         size_t key_length = 32,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
+    );
+    
+    /**
+     * @brief Вычислить общий ключ по кривой ключевой пары
+     * secp256r1 - ECDH, Curve25519 - X25519
+     * @param own_keys Собственная пара ключей
+     * @param peer_public_key Публичный ключ другой стороны (getKeyAgreementPublicKey)
+     * @param key_length Длина ключа в байтах
+     * @return Байты общего секретного ключа
+     */
+    static std::vector<uint8_t> deriveKey(
+        const ECCKeyPair& own_keys,
+        const std::vector<uint8_t>& peer_public_key,
+        size_t key_length = 32
     );
     
     /**
@@ -25,6 +25,27 @@ struct ECDSASignature {
      */
     static ECDSASignature fromDER(const std::vector<uint8_t>& der);
     
+    /**
+     * @brief Сериализовать подпись в raw формат r || s
+     * (по curve.orderBytes() байт big-endian, 64 байта для P-256)
+     * @throws std::invalid_argument если r или s не меньше порядка кривой
+     */
+    std::vector<uint8_t> toRaw(const Curve& curve = CurveRegistry::secp256r1()) const;
+    
+    /**
+     * @brief Записать raw подпись в буфер вызывающего (2 * curve.orderBytes() байт)
+     * @return Количество записанных байт
+     * @throws std::invalid_argument если буфер мал или r, s не меньше порядка кривой
+     */
+    size_t writeRaw(uint8_t* out, size_t capacity, const Curve& curve = CurveRegistry::secp256r1()) const;
+    
+    /**
+     * @brief Загрузить подпись из raw формата r || s
+     * @throws std::invalid_argument если длина не равна 2 * curve.orderBytes()
+     */
+    static ECDSASignature fromRaw(const uint8_t* data, size_t size, const Curve& curve = CurveRegistry::secp256r1());
+    static ECDSASignature fromRaw(const std::vector<uint8_t>& raw, const Curve& curve = CurveRegistry::secp256r1());
+    
     /**
      * @brief Конвертировать в hex строку (r:s)
      */
@@ -45,13 +66,14 @@ public:
      * @brief Создать цифровую подпись
      * @param message Данные для подписи
      * @param private_key Приватный ключ
-     * @param curve Параметры кривой
+     * @param curve Кривая из реестра
      * @return Подпись (r, s)
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static ECDSASignature sign(
         const std::vector<uint8_t>& message,
         const BigInt& private_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
     
     /**
@@ -59,33 +81,70 @@ public:
      * @param message Исходные данные
      * @param signature Подпись (r, s)
      * @param public_key Публичный ключ
-     * @param curve Параметры кривой
+     * @param curve Кривая из реестра
      * @return true если подпись валидна
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static bool verify(
         const std::vector<uint8_t>& message,
         const ECDSASignature& signature,
         const ECPoint& public_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
+    );
+    
+    /**
+     * @brief Подписать данные ключевой парой, алгоритм выбирается по кривой
+     * secp256r1 - ECDSA (raw r || s), Curve25519 - Ed25519 (R || S), оба по 64 байта
+     */
+    static std::vector<uint8_t> sign(
+        const std::vector<uint8_t>& message,
+        const ECCKeyPair& key_pair
+    );
+    
+    /**
+     * @brief Проверить подпись, созданную sign(message, key_pair)
+     * @param public_key Публичный ключ в сжатом формате (getPublicKeyCompressed)
+     */
+    static bool verify(
+        const std::vector<uint8_t>& message,
+        const std::vector<uint8_t>& signature,
+        const std::vector<uint8_t>& public_key,
+        const Curve& curve
+    );
+    
+    /**
+     * @brief Пакетная проверка подписей
+     * Для Curve25519 - Ed25519::verifyBatch, для остальных кривых - поочередная проверка
+     * Результат всегда совпадает с verify для каждой подписи; пустой пакет - true
+     * @return true если валидны все подписи
+     * @throws std::invalid_argument если размеры векторов не совпадают
+     */
+    static bool verifyBatch(
+        const std::vector<std::vector<uint8_t>>& messages,
+        const std::vector<std::vector<uint8_t>>& signatures,
+        const std::vector<std::vector<uint8_t>>& public_keys,
+        const Curve& curve
     );
     
     /**
      * @brief Создать подпись строки
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static std::string signString(
         const std::string& message,
         const BigInt& private_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
     
     /**
      * @brief Проверить подпись строки
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
      */
     static bool verifyString(
         const std::string& message,
         const std::string& signature_hex,
         const ECPoint& public_key,
-        const CurveParams& curve = EllipticCurve::getSecp256r1Params()
+        const Curve& curve = CurveRegistry::secp256r1()
     );
 
 private:
@@ -102,7 +161,7 @@ private:
     /**
      * @brief Генерация случайного k для подписи
      */
-    static BigInt generateK(const BigInt& private_key, const std::vector<uint8_t>& message_hash, const CurveParams& curve);
+    static BigInt generateK(const BigInt& private_key, const std::vector<uint8_t>& message_hash, const Curve& curve);
 };
 
 } // namespace e2e
@@ -4,6 +4,8 @@
 #include "bigint.h"
 #include <vector>
 #include <optional>
+#include <cstddef>
+#include <cstdint>
 
 namespace e2e {
 
@@ -83,8 +85,9 @@ public:
     
     /**
      * @brief Получить предопределенные параметры кривой secp256r1 (P-256)
+     * Ссылка на параметры из реестра CurveRegistry (разбираются один раз)
      */
-    static CurveParams getSecp256r1Params();
+    static const CurveParams& getSecp256r1Params();
 
 private:
     CurveParams params_;
@@ -97,6 +100,194 @@ private:
     BigInt modDiv(const BigInt& a, const BigInt& b) const;
 };
 
+/**
+ * @brief Идентификатор кривой в реестре
+ * Значения меньше 16: идентификатор занимает младшие 4 бита заголовка wire-конверта
+ */
+enum class CurveId : uint8_t {
+    SECP256R1 = 1,
+    CURVE25519 = 2
+};
+
+/**
+ * @brief Семейство кривой - определяет, какой бэкенд выполняет операции
+ */
+enum class CurveFamily : uint8_t {
+    SHORT_WEIERSTRASS, // y^2 = x^3 + ax + b, ECDH / ECDSA через EllipticCurve
+    CURVE25519         // X25519 / Ed25519 через curve25519.h
+};
+
+/**
+ * @brief Константы кривой в hex виде (разбираются в BigInt один раз при регистрации)
+ */
+struct CurveDescriptor {
+    CurveId id;
+    CurveFamily family;
+    const char* name;
+    const char* p;
+    const char* a;  // nullptr, если кривая не в форме Вейерштрасса
+    const char* b;  // nullptr, если кривая не в форме Вейерштрасса
+    const char* gx; // nullptr, если кривая не в форме Вейерштрасса
+    const char* gy; // nullptr, если кривая не в форме Вейерштрасса
+    const char* n;
+    uint32_t h;
+};
+
+/**
+ * @brief Константы кривой secp256r1 (P-256), SEC 2 / FIPS 186-4
+ */
+inline constexpr CurveDescriptor SECP256R1_DESCRIPTOR = {
+    CurveId::SECP256R1,
+    CurveFamily::SHORT_WEIERSTRASS,
+    "secp256r1",
+    "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF",
+    "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFC",
+    "5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B",
+    "6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296",
+    "4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5",
+    "FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551",
+    1
+};
+
+/**
+ * @brief Константы Curve25519 (RFC 7748 / RFC 8032): p = 2^255 - 19,
+ * n - порядок подгруппы базовой точки, кофактор 8
+ */
+inline constexpr CurveDescriptor CURVE25519_DESCRIPTOR = {
+    CurveId::CURVE25519,
+    CurveFamily::CURVE25519,
+    "curve25519",
+    "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED",
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    "1000000000000000000000000000000014DEF9DEA2F79CD65812631A5CF5D3ED",
+    8
+};
+
+/**
+ * @brief Неизменяемое описание кривой с предвычисленными данными
+ * Экземпляры создаются только реестром CurveRegistry и живут до конца процесса,
+ * поэтому API принимает их по ссылке и хранит по указателю
+ */
+class Curve {
+public:
+    Curve(const Curve&) = delete;
+    Curve& operator=(const Curve&) = delete;
+    
+    /**
+     * @brief Идентификатор кривой
+     */
+    CurveId id() const { return id_; }
+    
+    /**
+     * @brief Семейство кривой
+     */
+    CurveFamily family() const { return family_; }
+    
+    /**
+     * @brief Параметры кривой
+     * Для кривых Вейерштрасса - параметры из arithmetic() (без отдельной копии),
+     * для CURVE25519 заполнены только p, n, h и name
+     */
+    const CurveParams& params() const;
+    
+    /**
+     * @brief Арифметика точек на кривой
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
+     */
+    const EllipticCurve& arithmetic() const;
+    
+    /**
+     * @brief Константы Монтгомери для поля F_p и для порядка n
+     */
+    const MontgomeryContext& fieldMontgomery() const { return field_mont_; }
+    const MontgomeryContext& orderMontgomery() const { return order_mont_; }
+    
+    /**
+     * @brief Длина элемента поля и скаляра в байтах
+     */
+    size_t fieldBytes() const { return field_bytes_; }
+    size_t orderBytes() const { return order_bytes_; }
+    
+    /**
+     * @brief Длина публичного ключа в сжатом (0x02/0x03 + x) и несжатом (0x04 + x + y) формате
+     * Для CURVE25519 сжатый формат - 32 байта без префикса (RFC 7748 / RFC 8032)
+     */
+    size_t compressedPointBytes() const {
+        return family_ == CurveFamily::CURVE25519 ? field_bytes_ : 1 + field_bytes_;
+    }
+    size_t uncompressedPointBytes() const { return 1 + 2 * field_bytes_; }
+    
+    /**
+     * @brief Скалярное умножение базовой точки (k * G) по предвычисленной таблице
+     * Фиксированное окно шириной BASE_TABLE_WINDOW бит, без удвоений.
+     * k секретен (приватный ключ, nonce ECDSA), поэтому выбор из таблицы
+     * постоянного времени: просматриваются все 2^w элементов строки с условным
+     * копированием без ветвлений, адреса обращений к памяти не зависят от k
+     * @throws std::invalid_argument для кривых не в форме Вейерштрасса (CURVE25519)
+     */
+    ECPoint multiplyBase(const BigInt& k) const;
+    
+    /**
+     * @brief Ширина окна таблицы базовой точки в битах
+     */
+    static constexpr size_t BASE_TABLE_WINDOW = 4;
+
+private:
+    friend class CurveRegistry;
+    explicit Curve(const CurveDescriptor& descriptor);
+    
+    CurveId id_;
+    CurveFamily family_;
+    std::optional<EllipticCurve> arithmetic_; // Пусто для CURVE25519
+    std::optional<CurveParams> params_;       // Только для CURVE25519
+    MontgomeryContext field_mont_;
+    MontgomeryContext order_mont_;
+    size_t field_bytes_;
+    size_t order_bytes_;
+    
+    // base_table_[i * 2^w + j] = j * 2^(w*i) * G, w = BASE_TABLE_WINDOW
+    // Пусто для CURVE25519 (своя таблица в Ed25519)
+    std::vector<ECPoint> base_table_;
+};
+
+/**
+ * @brief Общий для процесса реестр неизменяемых кривых
+ * Кривая строится при первом обращении (потокобезопасно) и далее
+ * отдается по ссылке без копирования и повторного разбора констант
+ */
+class CurveRegistry {
+public:
+    /**
+     * @brief Получить кривую по идентификатору
+     * @throws std::invalid_argument если кривая не зарегистрирована
+     */
+    static const Curve& get(CurveId id);
+    
+    /**
+     * @brief Получить кривую по имени (например, "secp256r1")
+     * @throws std::invalid_argument если кривая не зарегистрирована
+     */
+    static const Curve& get(const std::string& name);
+    
+    /**
+     * @brief Кривая secp256r1 (P-256) - кривая по умолчанию
+     */
+    static const Curve& secp256r1();
+    
+    /**
+     * @brief Curve25519 (X25519 для обмена ключами, Ed25519 для подписей)
+     */
+    static const Curve& curve25519();
+    
+    /**
+     * @brief Описания всех зарегистрированных кривых
+     */
+    static const std::vector<const CurveDescriptor*>& descriptors();
+};
+
 } // namespace e2e
 
 #endif // ELLIPTIC_CURVE_H
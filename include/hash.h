@@ -29,6 +29,11 @@ public:
     static std::string sha256Hex(const std::vector<uint8_t>& data);
     static std::string sha256Hex(const std::string& data);
     
+    /**
+     * @brief Вычислить SHA-512 хеш (нужен для Ed25519)
+     */
+    static std::vector<uint8_t> sha512(const std::vector<uint8_t>& data);
+    
     /**
      * @brief HMAC-SHA256
      */
@@ -48,6 +53,8 @@ public:
     );
 
 private:
+    friend class HmacSha256;
+    
     // Внутренние функции SHA-256
     static void sha256ProcessBlock(
         const uint8_t* block,
@@ -55,6 +62,42 @@ private:
     );
     
     static uint32_t rightRotate(uint32_t value, size_t amount);
+    
+    // Внутренние функции SHA-512
+    static void sha512ProcessBlock(
+        const uint8_t* block,
+        uint64_t* hash
+    );
+    
+    static uint64_t rightRotate64(uint64_t value, size_t amount);
+};
+
+/**
+ * @brief Потоковый HMAC-SHA256
+ * Позволяет вычислить MAC над несколькими буферами без их склейки
+ */
+class HmacSha256 {
+public:
+    static constexpr size_t DIGEST_SIZE = 32;
+    
+    HmacSha256(const uint8_t* key, size_t key_size);
+    
+    /**
+     * @brief Добавить данные
+     */
+    void update(const uint8_t* data, size_t size);
+    
+    /**
+     * @brief Завершить вычисление и записать DIGEST_SIZE байт
+     */
+    void finish(uint8_t* out);
+
+private:
+    uint32_t state_[8];
+    uint8_t block_[64];
+    size_t block_size_ = 0;
+    uint64_t total_size_ = 0;
+    uint8_t outer_key_pad_[64]; // (K xor opad) для внешнего хеша
 };
 
 } // namespace e2e
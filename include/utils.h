@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace e2e {
 
@@ -12,29 +13,202 @@ namespace e2e {
  */
 namespace utils {
 
+/**
+ * @brief Набор SIMD-инструкций, используемый кодеками
+ * Определяется по cpuid один раз при первом вызове любого кодека или simdLevel(),
+ * глобальные флаги сборки не нужны:
+ * - GCC/Clang на x86-64: __get_cpuid, ядра SSE4.1/AVX2 с атрибутом target;
+ * - MSVC на x64: __cpuid, интринсики SSE4.1/AVX2 без /arch (MSVC их допускает);
+ * - остальные архитектуры и компиляторы: только SCALAR
+ */
+enum class SimdLevel {
+    SCALAR, // Переносимая табличная реализация
+    SSE41,  // 16 байт за итерацию (pshufb)
+    AVX2    // 32 байта за итерацию (vpshufb)
+};
+
+/**
+ * @brief Текущий уровень SIMD (при первом вызове определяется по cpuid)
+ */
+SimdLevel simdLevel();
+
+/**
+ * @brief Принудительно выбрать уровень SIMD (для тестов и отладки)
+ * Уровень ограничивается поддерживаемым процессором, что позволяет сверять
+ * ядра SCALAR/SSE41/AVX2 между собой на одной машине
+ * @return Фактически установленный уровень
+ */
+SimdLevel setSimdLevel(SimdLevel level);
+
+/**
+ * @brief Длина Base64 (с дополнением '=') для size байт
+ */
+size_t base64EncodedLength(size_t size);
+
+/**
+ * @brief Максимальная длина декодированных данных для encoded_size символов Base64
+ */
+size_t base64DecodedMaxLength(size_t encoded_size);
+
 /**
  * @brief Кодировать данные в Base64
  */
 std::string base64Encode(const std::vector<uint8_t>& data);
 
+/**
+ * @brief Кодировать данные в Base64 в буфер вызывающего
+ * @param out Буфер не меньше base64EncodedLength(size)
+ * @return Количество записанных символов
+ */
+size_t base64Encode(const uint8_t* data, size_t size, char* out);
+
 /**
  * @brief Декодировать данные из Base64
+ * @throws std::invalid_argument при недопустимом символе, длине или дополнении
  */
 std::vector<uint8_t> base64Decode(const std::string& encoded);
 
 /**
- * @brief Конвертировать вектор байт в hex строку
+ * @brief Декодировать данные из Base64 в буфер вызывающего
+ * @param out Буфер не меньше base64DecodedMaxLength(size)
+ * @return Количество записанных байт
+ * @throws std::invalid_argument при недопустимом символе, длине или дополнении
+ */
+size_t base64Decode(const char* encoded, size_t size, uint8_t* out);
+
+/**
+ * @brief Конвертировать вектор байт в hex строку (строчные буквы)
  */
 std::string toHex(const std::vector<uint8_t>& data);
 
 /**
- * @brief Конвертировать hex строку в вектор байт
+ * @brief Конвертировать байты в hex (строчные буквы) в буфер вызывающего
+ * @param out Буфер не меньше 2 * size
+ * @return Количество записанных символов
+ */
+size_t toHex(const uint8_t* data, size_t size, char* out);
+
+/**
+ * @brief Конвертировать hex строку в вектор байт (принимаются оба регистра)
+ * @throws std::invalid_argument при нечетной длине или недопустимом символе
  */
 std::vector<uint8_t> fromHex(const std::string& hex);
 
+/**
+ * @brief Конвертировать hex в байты в буфер вызывающего
+ * @param out Буфер не меньше size / 2
+ * @return Количество записанных байт
+ * @throws std::invalid_argument при нечетной длине или недопустимом символе
+ */
+size_t fromHex(const char* hex, size_t size, uint8_t* out);
+
+namespace detail {
+
+/**
+ * @brief Проверить hex-символы и перевести каждый в значение 0-15
+ * Любая длина (в том числе нечетная), оба регистра; SIMD-ядро выбирается
+ * по simdLevel(). Общее ядро для utils::fromHex и BigInt(hex)
+ * @param out Буфер не меньше size байт (по одному полубайту на символ)
+ * @throws std::invalid_argument при недопустимом символе
+ */
+void decodeHexNibbles(const char* hex, size_t size, uint8_t* out);
+
+} // namespace detail
+
+/**
+ * @brief Потоковый кодировщик Base64
+ * Хранит до 2 байт между вызовами update, поэтому результат не зависит
+ * от разбиения входа на части
+ */
+class Base64Encoder {
+public:
+    /**
+     * @brief Максимальный вывод update для size входных байт
+     */
+    static size_t maxUpdateLength(size_t size);
+    
+    /**
+     * @brief Закодировать очередную часть
+     * @param out Буфер не меньше maxUpdateLength(size)
+     * @return Количество записанных символов
+     */
+    size_t update(const uint8_t* data, size_t size, char* out);
+    
+    /**
+     * @brief Завершить поток (остаток и дополнение '='), не более 4 символов
+     * @return Количество записанных символов
+     */
+    size_t finish(char* out);
+    
+    void reset();
+
+private:
+    uint8_t pending_[2] = {0, 0};
+    size_t pending_size_ = 0;
+};
+
+/**
+ * @brief Потоковый декодировщик Base64 со строгой проверкой
+ * Хранит до 3 символов между вызовами update
+ */
+class Base64Decoder {
+public:
+    /**
+     * @brief Максимальный вывод update для size входных символов
+     */
+    static size_t maxUpdateLength(size_t size);
+    
+    /**
+     * @brief Декодировать очередную часть
+     * @param out Буфер не меньше maxUpdateLength(size)
+     * @return Количество записанных байт
+     * @throws std::invalid_argument при недопустимом символе или данных после '='
+     */
+    size_t update(const char* encoded, size_t size, uint8_t* out);
+    
+    /**
+     * @brief Завершить поток
+     * @throws std::invalid_argument если длина входа не кратна 4 или дополнение неверно
+     */
+    void finish();
+    
+    void reset();
+
+private:
+    char pending_[3] = {0, 0, 0};
+    size_t pending_size_ = 0;
+    bool padding_seen_ = false; // Встречено дополнение '='
+};
+
+/**
+ * @brief Потоковый декодировщик hex
+ * Хранит до 1 символа между вызовами update
+ */
+class HexDecoder {
+public:
+    /**
+     * @brief Декодировать очередную часть
+     * @param out Буфер не меньше (size + 1) / 2
+     * @return Количество записанных байт
+     * @throws std::invalid_argument при недопустимом символе
+     */
+    size_t update(const char* hex, size_t size, uint8_t* out);
+    
+    /**
+     * @brief Завершить поток
+     * @throws std::invalid_argument при нечетной общей длине
+     */
+    void finish();
+    
+    void reset();
+
+private:
+    char pending_ = 0;
+    bool has_pending_ = false;
+};
+
 } // namespace utils
 
 } // namespace e2e
 
 #endif // UTILS_H
-
@@ -0,0 +1,88 @@
+#ifndef WIRE_FORMAT_H
+#define WIRE_FORMAT_H
+
+#include "elliptic_curve.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace e2e {
+
+/**
+ * @brief Бинарный формат сообщений ECIES
+ *
+ * Конверт:
+ *   [1]   заголовок: версия (старшие 4 бита) | CurveId (младшие 4 бита),
+ *         поэтому версия и значения CurveId должны быть меньше 16
+ *   [K]   эфемерный публичный ключ в сжатом формате (curve.compressedPointBytes())
+ *   [12]  nonce
+ *   [1-MAX_VARINT_SIZE] длина шифртекста (varint, LEB128, size_t)
+ *   [N]   шифртекст
+ *   [16]  тег аутентификации
+ */
+namespace wire {
+
+constexpr uint8_t ENVELOPE_VERSION = 1;
+constexpr size_t NONCE_SIZE = 12;
+constexpr size_t TAG_SIZE = 16;
+constexpr size_t MAX_VARINT_SIZE = (sizeof(size_t) * 8 + 6) / 7; // 10 на 64-битных платформах, 5 на 32-битных
+
+/**
+ * @brief Разобранный конверт
+ * Указатели ссылаются на исходный буфер (без копирования) и живут не дольше него
+ */
+struct EnvelopeView {
+    uint8_t version = ENVELOPE_VERSION;
+    CurveId curve = CurveId::SECP256R1;
+    const uint8_t* ephemeral_key = nullptr;
+    size_t ephemeral_key_size = 0;
+    const uint8_t* nonce = nullptr;       // NONCE_SIZE байт
+    const uint8_t* ciphertext = nullptr;
+    size_t ciphertext_size = 0;
+    const uint8_t* tag = nullptr;         // TAG_SIZE байт
+};
+
+/**
+ * @brief Размер varint-кодирования значения
+ */
+size_t varintSize(size_t value);
+
+/**
+ * @brief Записать varint
+ * @return Количество записанных байт, 0 если не хватает места
+ */
+size_t writeVarint(size_t value, uint8_t* out, size_t capacity);
+
+/**
+ * @brief Прочитать varint
+ * Некорректными считаются неминимальные кодирования (например, 0x80 0x00)
+ * и значения больше SIZE_MAX, чтобы у шифртекста был ровно один конверт
+ * @return Количество прочитанных байт, 0 если данные обрезаны или некорректны
+ */
+size_t readVarint(const uint8_t* data, size_t size, size_t& value);
+
+/**
+ * @brief Размер сериализованного конверта
+ */
+size_t envelopeSize(const Curve& curve, size_t ciphertext_size);
+
+/**
+ * @brief Сериализовать конверт в буфер вызывающего
+ * @return Количество записанных байт
+ * @throws std::invalid_argument если capacity меньше envelopeSize или размер ключа
+ * не соответствует кривой
+ */
+size_t serializeEnvelope(const EnvelopeView& envelope, uint8_t* out, size_t capacity);
+
+/**
+ * @brief Разобрать конверт без копирования
+ * @throws std::invalid_argument при неизвестной версии или кривой, обрезанных данных,
+ * некорректной длине (см. readVarint) или лишних байтах после тега
+ */
+EnvelopeView parseEnvelope(const uint8_t* data, size_t size);
+
+} // namespace wire
+
+} // namespace e2e
+
+#endif // WIRE_FORMAT_H